@@ -97,6 +97,10 @@
 #define XtCLinesBelowCursor      "LinesBelowCursor"
 #define XtNlineBufferedConsole   "lineBufferredConsole"
 #define XtCLineBuffered          "LineBuffered"
+#define XtNmaxConsoleLines       "maxConsoleLines"
+#define XtCMaxConsoleLines       "MaxConsoleLines"
+#define XtNconsoleUpdateRate     "consoleUpdateRate"
+#define XtCConsoleUpdateRate     "ConsoleUpdateRate"
 #define XtNconsoleHasFocus       "consoleHasFocus"
 #define XtCConsoleHasFocus       "ConsoleHasFocus"
 #define XtNbashDisplayShortcuts  "bashDisplayShortcuts"
@@ -221,6 +225,8 @@
 #define XtCFindWordsOnly         "FindWordsOnly"
 #define XtNfindCaseSensitive     "findCaseSensitive"
 #define XtCFindCaseSensitive     "FindCaseSensitive"
+#define XtNfindRegexp            "findRegexp"
+#define XtCFindRegexp            "FindRegexp"
 #define XtNgroupIconify          "groupIconify"
 #define XtCGroupIconify          "GroupIconify"
 #define XtNuniconifyWhenReady    "uniconifyWhenReady"
@@ -250,8 +256,6 @@
 #define XtCBlockTTYInput         "BlockTTYInput"
 #define XtNbufferGDBOutput       "bufferGDBOutput"
 #define XtCBufferGDBOutput       "BufferGDBOutput"
-#define XtNmaxGlyphs             "maxGlyphs"
-#define XtCMaxGlyphs             "MaxGlyphs"
 #define XtNglyphUpdateDelay      "glyphUpdateDelay"
 #define XtCGlyphUpdateDelay      "GlyphUpdateDelay"
 #define XtNdisassemble           "disassemble"
@@ -410,6 +414,8 @@ struct AppData {
     Cardinal  lines_above_cursor;
     Cardinal  lines_below_cursor;
     Boolean   line_buffered_console;
+    Cardinal  max_console_lines;
+    Cardinal  console_update_rate;
     OnOff     console_has_focus;
     const _XtString    bash_display_shortcuts;
     const _XtString    dbg_display_shortcuts;
@@ -478,6 +484,7 @@ struct AppData {
     const _XtString    get_core_command;
     Boolean   find_words_only;
     Boolean   find_case_sensitive;
+    Boolean   find_regexp;
     Boolean   group_iconify;
     Boolean   uniconify_when_ready;
     Boolean   transient_dialogs;
@@ -493,7 +500,6 @@ struct AppData {
     OnOff     block_tty_input;
     OnOff     buffer_gdb_output;
     Cardinal  annotate;
-    Cardinal  max_glyphs;
     Boolean   disassemble;
     Cardinal  max_disassemble;
     Boolean   use_source_path;
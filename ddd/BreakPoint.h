@@ -33,6 +33,7 @@
 // A `BreakPoint' stores information about an existing debugger breakpoint.
 //-----------------------------------------------------------------------------
 
+#include <map>
 #include <vector>
 
 #include <X11/Intrinsic.h>
@@ -42,6 +43,7 @@
 #include "GDBAgent.h"
 #include "SourceView.h"
 #include "Command.h"
+#include "template/Map.h"
 
 extern class SourceView *source_view;
 
@@ -75,8 +77,6 @@ enum BPDispo {
     BPDIS			// Disable (`enable once' in GDB)
 };
 
-extern Map<int, BreakPoint> bp_map;
-
 class BreakPoint;
 
 class BreakPointLocn {
@@ -84,16 +84,12 @@ class BreakPointLocn {
     int     myline_nr;		// Line number
     string  myaddress;		// Address in memory
     string  myfunc;		// Function name
-    Widget  mysource_glyph;	// Associated glyph in source
-    Widget  mycode_glyph;	// Associated glyph in code
 public:
     BreakPointLocn():
 	myfile_name(""),
 	myline_nr(0),
 	myaddress(""),
-	myfunc(""),
-	mysource_glyph(0),
-	mycode_glyph(0)
+	myfunc("")
     {
     }
     // Breakpoint position
@@ -102,9 +98,6 @@ public:
     const string& address() const   { return myaddress; }
     string pos() const;
     const string& func() const      { return myfunc; }
-    // Associated glyphs in source and machine code
-    Widget& source_glyph() { return mysource_glyph; }
-    Widget& code_glyph()   { return mycode_glyph; }
     // Check if BP Locn in file & line
     bool is_match(const string& file, int line = 0)
     {
@@ -261,6 +254,87 @@ public:
     }
 };
 
+// All breakpoints, by number.  Iterating with first() and next()
+// yields breakpoints in ascending order of numbers.  Breakpoint
+// locations are also indexed by line, by file name, and by address;
+// after changing the location of a breakpoint, call reindex().
+class BreakPointMap {
+    struct Entry {
+	BreakPoint *bp;
+	std::vector<int> lines;			// Indexed lines
+	std::vector<string> files;		// Indexed file names
+	std::vector<unsigned long> addresses;	// Indexed addresses
+
+	Entry()
+	    : bp(0), lines(), files(), addresses()
+	{}
+    };
+
+    typedef std::map<int, Entry> Entries;
+    typedef std::map<int, std::vector<BreakPoint *> > LineIndex;
+    typedef std::map<string, std::vector<BreakPoint *> > FileIndex;
+    typedef std::map<unsigned long, std::vector<BreakPoint *> > AddressIndex;
+
+    Entries entries;
+    LineIndex lines;
+    FileIndex files;
+    AddressIndex addresses;
+
+    void index(Entry& e);
+    void unindex(Entry& e);
+
+    BreakPointMap(const BreakPointMap&);
+    BreakPointMap& operator = (const BreakPointMap&);
+
+public:
+    BreakPointMap()
+	: entries(), lines(), files(), addresses()
+    {}
+
+    // Insert or overwrite
+    void insert(int nr, BreakPoint *bp);
+
+    // Delete NR if found
+    void del(int nr);
+
+    // Get breakpoint NR; return 0 if not found
+    BreakPoint *get(int nr) const
+    {
+	Entries::const_iterator i = entries.find(nr);
+	return i == entries.end() ? 0 : i->second.bp;
+    }
+
+    // True if NR is contained
+    bool contains(int nr) const { return entries.find(nr) != entries.end(); }
+
+    int length() const { return entries.size(); }
+
+    // Update the index after the location of NR has changed
+    void reindex(int nr);
+
+    // Iteration, as with Map: first() and next() return 0 at the end.
+    // The current breakpoint may be deleted while iterating.
+    int first_key(MapRef& ref) const;
+    int next_key(MapRef& ref) const;
+    BreakPoint *first(MapRef& ref) const;
+    BreakPoint *next(MapRef& ref) const;
+
+    // Breakpoints with a location at LINE (in any file)
+    const std::vector<BreakPoint *>& at_line(int line) const;
+
+    // Breakpoints with a location at ADDRESS
+    const std::vector<BreakPoint *>& at_address(const string& address) const;
+
+    // Breakpoints with a location in FILE, or without file name
+    std::vector<BreakPoint *> in_file(const string& file) const;
+
+    // Breakpoints with a location from START to END (inclusive)
+    std::vector<BreakPoint *> in_range(const string& start,
+				       const string& end) const;
+};
+
+extern BreakPointMap bp_map;
+
 namespace BP
 {
   // Return specified breakpoint
@@ -276,9 +350,6 @@ namespace BP
   // Select breakpoint by position
   void select_bp_by_pos(string pos);
 
-  // Find BP Location by glyph
-  BreakPoint *find_bp_locn_by_glyph(Widget glyph, BreakPointLocn &locn);
-
   // Count selected breakpoints; return selected breakpoint
   BreakPoint *count_bps(int &enabled, int &disabled, int &selected);
 
@@ -307,6 +378,10 @@ namespace BP
   // Return all breakpoints/tracepoints at address
   std::vector<BreakPoint *> all_bps_at_address(const string &address);
 
+  // Return all breakpoints with a location from START to END
+  std::vector<BreakPoint *> all_bps_in_range(const string& start,
+                                             const string& end);
+
   // Return all breakpoint numbers
   std::vector<int> all_bp_numbers();
 
@@ -29,46 +29,90 @@
 #define _DDD_CodeCache_h
 
 #include "base/strclass.h"
+#include "SourceWidget.h"
 #include <ctype.h>
+#include <list>
+#include <map>
 #include <vector>
 
-// A single entry in the code cache
+// An instruction address and the start of its line in the code
+struct CodeAddress {
+    unsigned long address;
+    Utf8Pos pos;
+
+    bool operator < (const CodeAddress& a) const
+    {
+	return address < a.address;
+    }
+};
+
+// The addresses of all instructions in a piece of code, sorted
+typedef std::vector<CodeAddress> CodeIndex;
+
 struct CodeCacheEntry {
     string start;		// First location
     string end;			// Last location
     string code;		// Actual code
+    CodeIndex index;		// Instructions in CODE
 
     CodeCacheEntry()
-        : start(), end(), code()
+        : start(), end(), code(), index()
     {}
     CodeCacheEntry(const string& s, const string& e, const string& c)
-	: start(s), end(e), code(c)
-    {}
-    CodeCacheEntry(const CodeCacheEntry& cce)
-	: start(cce.start), end(cce.end), code(cce.code)
+	: start(s), end(e), code(c), index()
     {}
-    CodeCacheEntry& operator = (const CodeCacheEntry& cce)
-    {
-        if (this != &cce){
-	  start = cce.start;
-	  end   = cce.end;
-	  code  = cce.code;
-	}
-	return *this;
-    }
-    bool operator == (const CodeCacheEntry& cce) const
-    {
-	return start == cce.start
-	    && end == cce.end
-	    && code == cce.code;
-    }
-    bool operator != (const CodeCacheEntry& cce) const
-    {
-	return !operator==(cce);
-    }
 };
 
-typedef std::vector<CodeCacheEntry> CodeCache;
+// Disassembled code, by address.  Entries do not overlap; adding
+// code removes older entries for the same addresses.  If the cache
+// grows beyond its maximum size, the least recently used entries are
+// removed.
+class CodeCache {
+    struct Entry {
+	CodeCacheEntry code;
+	unsigned long start;	// Numeric CODE.start
+	unsigned long end;	// Numeric CODE.end
+	std::list<Entry *>::iterator lru;
+    };
+
+    typedef std::map<unsigned long, Entry> Entries; // by start address
+
+    Entries entries;
+    std::list<Entry *> lru;	// All entries, most recently used first
+    size_t size;		// Total size of code
+
+    void remove(Entries::iterator i);
+
+    CodeCache(const CodeCache&);
+    CodeCache& operator = (const CodeCache&);
+
+public:
+    CodeCache();
+
+    // Add CODE for START to END; INDEX is its index_code()
+    void add(const string& start, const string& end, const string& code,
+	     const CodeIndex& index);
+
+    // Return code containing PC; 0 if none.  The code becomes the
+    // most recently used.
+    const CodeCacheEntry *find(const string& pc);
+
+    // True iff there is code containing PC.  Unlike find(), this
+    // does not change the order of removal.
+    bool contains(const string& pc) const;
+
+    // Remove all entries
+    void clear();
+};
+
+// Store numeric value of ADDRESS in VALUE; return true iff ok
+bool parse_address(const string& address, unsigned long& value);
+
+// Fill INDEX with the instruction addresses in disassembled CODE
+void index_code(const string& code, CodeIndex& index);
+
+// Return position of line of PC in code indexed by INDEX; -1 if none
+Utf8Pos find_address(const CodeIndex& index, const string& pc);
 
 
 // Compare addresses: 
@@ -75,6 +75,7 @@ public:
     static string  vsllib_path;
     static string  vsllib_defs;
     static string  vsllib_base_defs;
+    static string  vsllib_image_dir;
     static int     max_display_title_length;
     static bool    align_2d_arrays;
 
@@ -90,6 +91,10 @@ public:
     // Clear cache
     static void clear_vsllib_cache();
 
+    // VSL evaluation profile of all libraries in use
+    static void profile_vsllib(std::ostream& os);
+    static void reset_vsllib_profile();
+
     // Create a new box.  If DV == 0, create a disabled box.
     DispBox (int disp_nr, const string& title, 
 	     const DispValue *dv = 0, const DispValue *parent = 0);
@@ -44,6 +44,12 @@ public:
     int base;			// Data already processed
     int total;			// Total of data to be processed
 
+    // By default, data is counted in characters.  Clients counting
+    // other units (say, graph items) should scale these accordingly.
+    int update_threshold;	// Update meter every UPDATE_THRESHOLD units
+    int dialog_threshold;	// Popup dialog from DIALOG_THRESHOLD units
+    int quiet_tail;		// Don't update for the last QUIET_TAIL units
+
     ProgressMeter(const char *msg);
     ~ProgressMeter();
 
@@ -60,6 +66,9 @@ private:
     // Popup working dialog when updating from at least DIALOG_THRESHOLD chars.
     static const int DIALOG_THRESHOLD;
 
+    // Don't update progress meter for the last QUIET_TAIL characters.
+    static const int QUIET_TAIL;
+
     static Widget dialog;
     static Widget scale;
 
@@ -43,6 +43,7 @@
 #include "GDBAgent.h"
 
 #include "SourceWidget.h" 
+#include "SourceSearch.h"
 
 //-----------------------------------------------------------------------------
 extern GDBAgent* gdb;
@@ -54,8 +55,23 @@ public:
     enum SourceOrigin { ORIGIN_LOCAL, ORIGIN_REMOTE, ORIGIN_GDB, ORIGIN_NONE };
 
 private:
+    // A source text, along with its line index.  Once indexed, a
+    // text does not change; it is shared between the current source,
+    // the source file cache, and the source window.
+    struct SourceText : public XmhTextBuffer
+    {
+        string source;
+        int char_count = 0;
+
+        const char *chars() const override { return source.chars(); }
+        Utf8Pos length() const override { return source.length(); }
+
+        // Set up line index and character count
+        void index();
+    };
+
     // The current source text.
-    string current_source = "";
+    std::shared_ptr<SourceText> current = std::make_shared<SourceText>();
 
     // Tab width
     int tab_width = DEFAULT_TAB_WIDTH;
@@ -63,8 +79,6 @@ private:
     // File attributes
     string current_file_name = "";
     int line_count = 0;
-    int char_count = 0;
-    std::vector<Utf8Pos> bytepos_of_line;
 
     // The origin of the current source text.
     SourceOrigin current_origin = ORIGIN_NONE;
@@ -72,16 +86,46 @@ private:
     // Check whether source files and code are to be cached
     bool cache_source_files = true;
 
+    // Syntax highlighting tokens.  These are computed incrementally;
+    // tokenizing resumes at CHECKPOINT.
+    struct TokenCache
+    {
+        std::vector<XmhColorToken> tokens;
+        Utf8Pos checkpoint = 0;
+        int tab_width = 0;          // Tab width the positions refer to
+        bool complete = false;      // True iff all of the text is done
+    };
+
+    // Results of recent searches, most recent last
+    struct SearchCache
+    {
+        std::vector<SourceSearch> searches;
+        int tab_width = 0;          // Tab width the positions refer to
+    };
+
     // source file caches
     struct FileCacheEntry
     {
-        string text;
+        std::shared_ptr<SourceText> text; // Not untabified
         SourceOrigin origin;
         string file_name; // File name of current source (for JDB)
+        TokenCache tokens;
+        SearchCache searches;
     };
     std::map<string, FileCacheEntry> filecache;
     std::map<string, string> source_name_cache;
 
+    // Tokens of the current source (in FILECACHE, if cached)
+    TokenCache uncached_tokens;
+    TokenCache *current_tokens = &uncached_tokens;
+
+    // Searches in the current source (in FILECACHE, if cached)
+    SearchCache uncached_searches;
+    SearchCache *current_searches = &uncached_searches;
+
+    // Tokenize another bunch of lines
+    void tokenize_step();
+
     Widget source_text_w = 0;
 
     // Files listed as erroneous
@@ -108,15 +152,16 @@ public:
     string current_pwd = cwd();
 
     // access functions for source
-    const string& get_source() { return current_source; }
-    unsigned int get_length() { return current_source.length(); }
+    const string& get_source() { return current->source; }
+    unsigned int get_length() { return current->source.length(); }
+    std::shared_ptr<const XmhTextBuffer> get_buffer() { return current; }
     const subString get_source_at(Utf8Pos pos, int length);
 
     // access functions for file attributes
     const string& get_filename()  { return current_file_name; }
     void reset_filename() { current_file_name = ""; }
     int get_num_lines() {return line_count+1; }
-    int get_num_characters() {return char_count; }
+    int get_num_characters() {return current->char_count; }
     SourceOrigin get_origin() { return current_origin; }
     Utf8Pos getEndoflineAtBytepos(Utf8Pos pos);
     const subString getSourceLine(int line);
@@ -135,7 +180,20 @@ public:
     int calculate_indent(Utf8Pos pos = -1);
 
     // True iff we have some source text
-    bool have_source() { return current_source.length() != 0; }
+    bool have_source() { return current->source.length() != 0; }
+
+    // Syntax highlighting tokens of the current source, as far as known
+    const std::vector<XmhColorToken>& get_tokens() { return current_tokens->tokens; }
+    bool tokens_complete() { return current_tokens->complete; }
+
+    // Tokenize current source up to at least line LINE (or another
+    // bunch of lines if LINE is 0).  Return index of first new token.
+    size_t tokenize(int line = 0);
+
+    // Find all matches of KEY in the current source.  Results are
+    // cached per file and search.
+    const SourceSearch& find_all(const string& key, bool words_only,
+                                 bool case_sensitive, bool regexp);
 
     // Caches
     void clear_file_cache();
@@ -0,0 +1,69 @@
+// $Id$ -*- C++ -*-
+// Find all matches of a search key in a source text
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_SourceSearch_h
+#define _DDD_SourceSearch_h
+
+#include <vector>
+
+#include "base/strclass.h"
+#include "SourceWidget.h"
+
+// A search in a source text, along with its results.  KEY is either
+// a plain string or an extended regular expression (if REGEXP is
+// set).  If WORDS_ONLY is set, matches that are part of a larger
+// identifier are skipped.
+struct SourceSearch
+{
+    string key;
+    bool words_only = false;
+    bool case_sensitive = true;
+    bool regexp = false;
+
+    // All matches, in ascending order and not overlapping.  Only
+    // START and LEN are set.
+    std::vector<XmhColorToken> matches;
+
+    // Error message if KEY is not a valid regular expression
+    string error;
+
+    // True iff S searches for the same as this search
+    bool same(const SourceSearch& s) const
+    {
+        return key == s.key &&
+            words_only == s.words_only &&
+            case_sensitive == s.case_sensitive &&
+            regexp == s.regexp;
+    }
+};
+
+// Find all matches of SEARCH in TEXT (LENGTH bytes, followed by a
+// NUL byte) and store them in SEARCH.MATCHES.  Return false and set
+// SEARCH.ERROR if the key is no valid regular expression.
+bool SearchAll(const char *text, size_t length, SourceSearch& search);
+
+#endif // _DDD_SourceSearch_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -4,7 +4,22 @@
 
 #include "SourceWidget.h"
 
+#include <string>
+#include <vector>
+
 void TokenizeCpp_BreezeLight(const char* text, size_t length, std::vector<XmhColorToken>& out);
+
+// Tokenize TEXT from byte position START (which must be a position
+// returned by an earlier call, or 0) until at least position STOP.
+// Returns the position where tokenizing stopped; resuming from there
+// yields the same tokens as tokenizing everything at once.
+size_t TokenizeCpp_BreezeLight(const char* text, size_t length, size_t start, size_t stop,
+                               std::vector<XmhColorToken>& out);
 void TokenizeGdbDisassembly(const char* text, size_t length, std::vector<XmhColorToken>& out);
 
+// Append the targets of direct calls in disassembled TEXT to OUT,
+// as found in TOKENS (the output of TokenizeGdbDisassembly)
+void GdbDisassemblyCallTargets(const char* text, const std::vector<XmhColorToken>& tokens,
+                               std::vector<std::string>& out);
+
 #endif // SOURCETOKENIZER_H
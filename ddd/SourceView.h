@@ -46,6 +46,7 @@
 #ifndef _DDD_SourceView_h
 #define _DDD_SourceView_h
 
+#include <map>
 #include <vector>
 
 // Motif includes
@@ -55,7 +56,6 @@
 #include "base/strclass.h"
 #include "template/Assoc.h"
 #include "motif/MakeMenu.h"
-#include "template/IntIntAA.h"
 
 // DDD includes
 #include "ArgField.h"
@@ -142,7 +142,6 @@ class SourceView {
     static void ThreadCommandCB  (Widget, XtPointer, XtPointer);
 
     static void SetWatchModeCB(Widget, XtPointer, XtPointer);
-    static void ActivateGlyphCB(Widget, XtPointer, XtPointer);
 
     // Set shell title
     static void update_title();
@@ -262,9 +261,9 @@ class SourceView {
 
     static Widget toplevel_w;         // Top-level widget
 
-    static Widget source_form_w; // Form around text and glyphs
+    static Widget source_form_w; // Form around text
     static Widget source_text_w; // Source text
-    static Widget code_form_w;   // Form around Machine code and glyphs
+    static Widget code_form_w;   // Form around Machine code
     static Widget code_text_w;   // Machine code text
 
     static Widget edit_breakpoints_dialog_w; // Dialog for editing breakpoints
@@ -297,8 +296,9 @@ class SourceView {
     static WatchMode selected_watch_mode;     // Last selected watch mode
 
     // File attributes
-    static IntIntArrayAssoc bps_in_line;  // non-glyph breakpoints in current source
+    static std::map<int, std::vector<int>> bps_in_line; // breakpoints per source line
     static std::vector<string> bp_addresses; // breakpoint addresses in current code
+    static SourceSearch highlighted_search;  // search highlighted in source
 
     // True iff FILE is the currently loaded file
     static bool is_current_file(const string& file);
@@ -315,6 +315,7 @@ class SourceView {
     static string current_code;
     static string current_code_start;
     static string current_code_end;
+    static CodeIndex current_code_index;
 
     // The current directory
     static string current_pwd;
@@ -356,7 +357,21 @@ class SourceView {
     static void refresh_codeOQC(const string& answer, void *data);
     static void set_code(const string& code,
                          const string& start,
-                         const string& end);
+                         const string& end,
+                         const CodeIndex& index);
+    static string disassembled_code(const string& disassemble_output);
+
+    // Prefetching code for calls and the caller in the background
+    static std::vector<string> current_code_calls; // call targets
+    static std::vector<string> prefetching;        // pending addresses
+    static string caller_prefetched_pc; // PC whose caller was prefetched
+    static int code_cache_generation;   // Changes when cache is cleared
+    static XtWorkProcId prefetch_proc;
+    static void prefetch_code();
+    static void prefetch_code_at(const string& address);
+    static Boolean PrefetchCodeWorkProc(XtPointer);
+    static void prefetch_callerOQC(const string& answer, void *data);
+    static void prefetch_codeOQC(const string& answer, void *data);
 
     static MString help_on_bp(int bp, bool detailed);
 
@@ -383,28 +398,29 @@ class SourceView {
     // Glyphs
     //-----------------------------------------------------------------------
 
-    // Create glyph in FORM_W named NAME
-    static Widget create_glyph(Widget form_w, const _XtString name);
+    // Glyphs are marks drawn by the text widgets.  A mark id is a
+    // breakpoint number or one of these.
+    enum {
+        PLAIN_ARROW_MARK  = -1,
+        GREY_ARROW_MARK   = -2,
+        PAST_ARROW_MARK   = -3,
+        SIGNAL_ARROW_MARK = -4,
+        DRAG_MARK         = -5
+    };
 
-    // Map glyph W in (X, Y)
-    static void map_glyph(Widget& w, Position x, Position y);
+    // Return mark showing glyph NAME at POS in TEXT_W
+    static XmhColorTextMark glyph_mark(Widget text_w, const _XtString name,
+                                       Utf8Pos pos, int x, int id);
 
-    // Unmap glyph W
-    static void unmap_glyph(Widget w);
-
-    // Report glyph state (for debugging)
-    static void log_glyph(Widget w, int n = -1);
-    static void log_glyphs();
+    // Pass the marks of TEXT_W to the widget
+    static void show_marks(Widget text_w);
 
     // Return position during glyph drag and drop
     static Utf8Pos glyph_position(Widget w, XEvent *e,
                                          bool normalize = true);
 
-    // Get relative coordinates of GLYPH in TEXT
-    static void translate_glyph_pos(Widget glyph, Widget text, int& x, int& y);
-
     // Data associated with current drag operation
-    // The Glyph being dragged
+    // The text widget a glyph is dragged in
     static Widget current_drag_origin;
 
     // The breakpoint being dragged, or 0 if execution position
@@ -423,50 +439,26 @@ public:
     static int glyph_scalefactor;
 
 private:
-    // Glyph locations: X[0] is source, X[1] is code
-    static Widget plain_arrows[2];
-    static Widget grey_arrows[2];
-    static Widget past_arrows[2];
-    static Widget signal_arrows[2];
-    static Widget drag_arrows[2];
-    static std::vector<Widget> plain_stops[2];
-    static std::vector<Widget> grey_stops[2];
-    static std::vector<Widget> multi_stops[2];
-    static std::vector<Widget> plain_conds[2];
-    static std::vector<Widget> grey_conds[2];
-    static std::vector<Widget> multi_conds[2];
-    static std::vector<Widget> plain_temps[2];
-    static std::vector<Widget> grey_temps[2];
-    static std::vector<Widget> multi_temps[2];
-    static Widget drag_stops[2];
-    static Widget drag_conds[2];
-    static Widget drag_temps[2];
-
-    // Return position POS of glyph GLYPH in X/Y.  Return true iff displayed.
-    static bool pos_to_xy(Widget glyph, Utf8Pos pos,
-                                Position& x, Position& y);
-
-    // Map stop sign in W at position POS.  Get widget from STOPS[COUNT];
-    // store location in POSITIONS.  Return mapped widget (0 if none)
-    static Widget map_stop_at(Widget w, Utf8Pos pos,
-                              WidgetArray& stops, int& count,
-                              std::vector<Utf8Pos>& positions);
-
-    // Map arrow/drag arrow/drag stop in W at POS.  If ORIGIN is
-    // given, use colors from ORIGIN.
-    static Widget map_arrow_at     (Widget w, Utf8Pos pos);
-    static Widget map_drag_arrow_at(Widget w, Utf8Pos pos);
-    static inline void unmap_drag_arrow(Widget w)
+    // Glyph marks: X[0] is source, X[1] is code
+    static std::vector<XmhColorTextMark> glyph_marks[2];
+    static XmhColorTextMark drag_marks[2];
+
+    // Add stop sign NAME at position POS to MARKS.  STOPS counts the
+    // stop signs added so far, per position.
+    static void add_stop_at(Widget w, Utf8Pos pos, const _XtString name,
+                            int bp_nr, std::vector<XmhColorTextMark>& marks,
+                            std::map<Utf8Pos, int>& stops);
+
+    // Add arrow in W at POS to MARKS
+    static void add_arrow_at(Widget w, Utf8Pos pos,
+                             std::vector<XmhColorTextMark>& marks);
+
+    // Show drag arrow/drag stop in W at POS; Utf8Pos(-1) hides it
+    static void map_drag_glyph_at(Widget w, Utf8Pos pos);
+    static inline void unmap_drag_glyph(Widget w)
     {
-        map_drag_arrow_at(w, Utf8Pos(-1));
+        map_drag_glyph_at(w, Utf8Pos(-1));
     }
-    static Widget map_drag_stop_at (Widget w, Utf8Pos pos,
-                                    Widget origin = 0);
-    static inline void unmap_drag_stop(Widget w)
-    {
-        map_drag_stop_at(w, Utf8Pos(-1));
-    }
-    static void copy_colors(Widget w, Widget origin);
 
     // True if code/source glyphs need to be updated
     static bool update_code_glyphs;
@@ -474,18 +466,17 @@ private:
 
     // Helping background procedures
     static void UpdateGlyphsWorkProc(XtPointer, XtIntervalId *);
-    static Boolean CreateGlyphsWorkProc(XtPointer);
+
+    // Syntax highlighting: tokenize visible lines first, the rest
+    // in the background
+    static XtWorkProcId tokenize_proc;
+    static Boolean TokenizeWorkProc(XtPointer);
+    static void tokenize_source(int line = 0);
+    static void tokenize_visible_source();
 
     // Update all glyphs now (without delay).
     static void update_glyphs_now();
 
-    // Return all glyphs that would change
-    static const WidgetArray& glyphs_to_be_updated();
-
-    // Helpers needed by glyphs_to_be_changed
-    static bool change_glyphs;
-    static WidgetArray changed_glyphs;
-
     // Callback when state has been reset
     static void reset_done(const string& answer, void *data);
 
@@ -499,8 +490,6 @@ public:
     // Constructor
     SourceView(Widget parent);
 
-    ~SourceView();
-
     // Shell constructor
     void create_shells();
 
@@ -569,13 +558,16 @@ public:
     // Set frame manually to function FUNC; return True if found
     static bool set_frame_func(const string& func);
 
-    // Find S in current source; select it at TIME.
+    // Find S in current source; select it at TIME.  All matches
+    // are highlighted.  If REGEXP is set, S is an extended regular
+    // expression.
     enum SearchDirection {forward, backward};
 
     static void find(const string& s,
                      SearchDirection direction = forward,
                      bool words_only = false,
                      bool case_sensitive = false,
+                     bool regexp = false,
                      Time time = CurrentTime);
 
     // Locate function S; if S is omitted, locate last execution position.
@@ -642,9 +634,6 @@ public:
     // Set the tab width
     static void set_tab_width(int width);
 
-    // Set the max number of glyphs
-    static void set_max_glyphs(int max_glyphs);
-
     // Maximum length of expr in source popup
     static int max_popup_expr_length;
 
@@ -750,8 +739,7 @@ public:
     // Get the line at POSITION
     static string get_line(string position);
 
-    // Get a help string for GLYPH; return 0 if none
-    static MString help_on_glyph(Widget glyph, bool detailed);
+    // Get a help string for the breakpoint at POS in W; return 0 if none
     static MString help_on_pos(Widget w, Utf8Pos pos,
                                Utf8Pos& ref, bool detailed);
 
@@ -4,6 +4,7 @@
 
 #include <Xm/Xm.h>
 #include <vector>
+#include <memory>
 
 
 /*!
@@ -19,6 +20,23 @@ enum {
     XMH_STYLE_ITALIC = 1 << 1
 };
 
+/*!
+ * \brief Text shown in a viewer, along with the start of each line.
+ * \note A buffer must not change once passed to a viewer; the viewer
+ *       shares it with its owner instead of copying it.
+ */
+struct XmhTextBuffer
+{
+    virtual ~XmhTextBuffer() {}
+    virtual const char *chars() const = 0;  // NUL-terminated UTF-8
+    virtual Utf8Pos length() const = 0;     // in bytes
+
+    std::vector<Utf8Pos> line_starts;       // 0, and one past each '\n'
+};
+
+// Fill in LINE_STARTS of BUFFER
+void XmhTextBufferIndexLines(XmhTextBuffer &buffer);
+
 struct XmhColorToken
 {
     Utf8Pos start = 0;   // byte start
@@ -27,6 +45,21 @@ struct XmhColorToken
     int    style = 0;   // bitmask: XMH_STYLE_*
 };
 
+/*!
+ * \brief An image in the breakpoint area of a line, such as a
+ *        breakpoint or the execution position.
+ */
+struct XmhColorTextMark
+{
+    Utf8Pos pos = 0;       // a position in the line
+    int    x = 0;          // offset from the start of the text (px)
+    Pixmap pixmap = None;  // image, in the depth of the widget
+    Pixmap mask = None;    // shape of the image (depth 1), or None
+    int    width = 0;
+    int    height = 0;
+    int    id = 0;         // client data
+};
+
 // Widget resources for XtVaSetValues/XtVaGetValues
 #define XmhNstring     ((char*)"string")
 #define XmhNfontFamily ((char*)"fontFamily")
@@ -44,6 +77,7 @@ Widget CreateXmhColorTextView(Widget parent, const char *name, Arg *args, Cardin
 
 // Content
 void   XmhColorTextViewSetString(Widget w, const char *utf8);
+void   XmhColorTextViewSetBuffer(Widget w, std::shared_ptr<const XmhTextBuffer> buffer);
 char*  XmhColorTextViewGetString(Widget w);               // caller frees with free()
 Utf8Pos XmhColorTextViewGetLastPosition(Widget w);
 
@@ -52,6 +86,15 @@ void XmhColorTextViewDarkMode(Widget w, Boolean enable);
 
 // Coloring (syntax highlighting)
 void   XmhColorTextViewSetTokens(Widget w, const XmhColorToken *tokens, int count);
+void   XmhColorTextViewAppendTokens(Widget w, const XmhColorToken *tokens, int count);
+
+// Highlighted ranges (search hits); only START and LEN are used
+void   XmhColorTextViewSetHighlights(Widget w, const XmhColorToken *ranges, int count);
+
+// Marks (breakpoints, execution position); later marks are drawn on top
+void    XmhColorTextViewSetMarks(Widget w, const XmhColorTextMark *marks, int count);
+Boolean XmhColorTextViewMarkAt(Widget w, Position x, Position y, int *id);
+Boolean XmhColorTextViewMarkAtPos(Widget w, Utf8Pos pos, int *id);
 
 // Selection
 int    XmhColorTextViewGetSelectionPosition(Widget w, Utf8Pos *left, Utf8Pos *right);
@@ -36,6 +36,7 @@ struct PrintGC {
 
     virtual bool isFig() const        { return false; }
     virtual bool isPostScript() const { return false; }
+    virtual bool isSVG() const        { return false; }
     virtual ~PrintGC() {}
 };
 
@@ -70,5 +71,17 @@ struct PostScriptPrintGC: public PrintGC {
     {}
 };
 
+struct SVGPrintGC: public PrintGC {
+    DECLARE_TYPE_INFO
+
+    virtual bool isSVG() const        { return true; }
+
+    bool color;			// Whether to print in color
+
+    SVGPrintGC()
+	: color(false)
+    {}
+};
+
 #endif // _DDD_PrintGC_h
 // DON'T ADD ANYTHING BEHIND THIS #endif
@@ -64,6 +64,7 @@ public:
 
     // Statistics
     static unsigned long inUse()   { return ids; }     // # of existing Ids
+    static unsigned long created() { return tics - 1; } // # of Ids ever created
 };
 
 #endif
@@ -53,6 +53,9 @@ private:
 		GC gc, 
 		bool context_selected) const;
 
+    // Bounding box of the entire ellipse, given the region of the arc
+    void arcRegion(BoxPoint& origin, BoxSize& space) const;
+
     void _printPS(std::ostream& os, 
 		  const BoxRegion& region, 
 		  const PrintGC& gc) const;
@@ -89,6 +92,18 @@ public:
     // Resources
     BoxDegrees start() const { return _start; }
     BoxDegrees length() const { return _length; }
+
+    // Structural hashing
+    unsigned int hash() const
+    {
+	return hashmix(hashmix(LineBox::hash(), _start), _length);
+    }
+    bool identical(const Box& b) const
+    {
+	return LineBox::identical(b) &&
+	    _start == ((const ArcBox *)&b)->_start &&
+	    _length == ((const ArcBox *)&b)->_length; // dirty trick
+    }
 };
 
 #endif
@@ -64,10 +64,16 @@ private:
     BoxSize _size;		// Size
     BoxExtend _extend;		// Extensibility
     const char *_type;		// type
+    unsigned int _intern_hash;	// Hash in intern table (0: not interned)
+
+    static int hash_budget;	// Boxes HASH() may still visit (-1: all)
 
     static void epsHeader (std::ostream& os, 
 			   const BoxRegion& region, 
 			   const PostScriptPrintGC& gc);
+    static void svgHeader (std::ostream& os, 
+			   const BoxRegion& region, 
+			   const SVGPrintGC& gc);
 
     Box& operator = (const Box&);
 
@@ -82,12 +88,21 @@ protected:
     // Copy constructor
     Box(const Box& box):
 	_id(), _size(box._size), _extend(box._extend), 
-	_type(box._type), _links(1)
+	_type(box._type), _intern_hash(0), _links(1)
     {}
 	
     // Equality
     virtual bool matches(const Box& b, const Box *callbackArg = 0) const;
 
+    // Combine hash value H with X; an unshareable H stays 0
+    static unsigned int hashmix(unsigned int h, unsigned int x)
+    {
+	if (h == 0)
+	    return 0;
+	h = h * 31 + x;
+	return h == 0 ? 1 : h;
+    }
+
     // Draw box
     virtual void _draw(Widget w, 
 		       const BoxRegion& region, 
@@ -101,13 +116,15 @@ public:
     // Constructor
     Box(BoxSize s = BoxSize(0, 0), BoxExtend e = BoxExtend(0, 0), 
 	const char *t = "Box"):
-	_id(), _size(s), _extend(e), _type(t), _links(1)
+	_id(), _size(s), _extend(e), _type(t), _intern_hash(0), _links(1)
     {}
 
     // Destructor
     virtual ~Box()
     {
 	assert (_links == 0);
+	if (_intern_hash != 0)
+	    unintern();
 	_type = 0;
     }
 
@@ -203,6 +220,33 @@ public:
     bool operator == (const Box& b) const;
     bool operator != (const Box& b) const { return !(operator == (b)); }
 
+    // Structural hashing.  HASH() returns 0 if the box must not be
+    // shared (because it is tagged, for instance).  IDENTICAL() is
+    // stricter than ==, comparing fonts and colors as well.
+    virtual unsigned int hash() const;
+    virtual bool identical(const Box& b) const;
+
+    // Like HASH(), but return 0 if the box has more than MAX_BOXES
+    // components, such that hashing large boxes stops early.
+    unsigned int boundedHash(int max_boxes) const;
+
+    // Flag: is this box referenced more than once?
+    bool isShared() const { return _links > 1; }
+
+    // Share this box with all identical boxes.  Interned boxes must
+    // not be changed; use dup() to get a private copy.
+    // Usage: box = box->intern()
+    virtual Box *intern();
+
+    // Flag: is this box interned?
+    bool isInterned() const { return _intern_hash != 0; }
+
+    // Remove this box from the intern table (before changing it)
+    void unintern();
+
+    // Number of interned boxes
+    static int interned();
+
     // Check class
     virtual bool isStringBox() const  { return false; }
     virtual bool isListBox() const    { return false; }
@@ -29,6 +29,7 @@
 #define _DDD_ColorBox_h
 
 #include "base/strclass.h"
+#include "base/hash.h"
 #include "Box.h"
 #include "THatBox.h"
 #include "base/TypeInfo.h"
@@ -101,6 +102,17 @@ public:
     unsigned short green() const     { return _green; }
     unsigned short blue()  const     { return _blue; }
 
+    // Structural hashing
+    unsigned int hash() const
+    {
+	return hashmix(TransparentHatBox::hash(), hashpjw(_color_name.chars()));
+    }
+    bool identical(const Box& b) const
+    {
+	return TransparentHatBox::identical(b) &&
+	    _color_name == ((const ColorBox *)&b)->_color_name; // dirty trick
+    }
+
     // Set RGB color directly
     void set_rgb(unsigned short red, unsigned short green, unsigned short blue)
     {
@@ -128,6 +128,10 @@ public:
 
     void countMatchBoxes(int instances[]) const;
 
+    // Structural hashing
+    unsigned int hash() const;
+    bool identical(const Box& b) const;
+
     bool OK() const;
 };
 
@@ -0,0 +1,138 @@
+// $Id$
+// Collect X drawing requests
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_DrawBatch_h
+#define _DDD_DrawBatch_h
+
+#include <X11/Xlib.h>
+#include <X11/Intrinsic.h>
+#include <X11/Xft/Xft.h>
+
+#include <map>
+#include <vector>
+
+#include "base/strclass.h"
+
+// While a DrawBatch exists, boxes and graphs do not draw right away.
+// Instead, lines, rectangles, arcs, polygons and text are collected
+// per drawable and GC (text: per font and color) and sent as a few
+// XDrawSegments(), XFillRectangles(), XDrawArcs(), XFillPolygon() and
+// XftDrawGlyphSpec() requests when the batch is flushed.
+//
+// Filled rectangles are drawn first, in the order given; then lines,
+// arcs, polygons and text.  Since filling is used for backgrounds,
+// adding a rectangle flushes everything else collected so far.
+// Whoever draws directly while a batch exists must flush() first.
+//
+// Requests are drawn with the GC settings in effect at flush time;
+// hence, flush() must be called before changing a GC while drawing.
+//
+// Batches nest: only the outermost batch collects and flushes.  If no
+// batch exists, requests are drawn right away.
+
+class DrawBatch {
+    Display *display;		// Display drawn upon
+    DrawBatch *saved;		// Enclosing batch
+
+    typedef std::pair<Drawable, GC> Target;
+
+    struct Fill {
+	Target target;
+	std::vector<XRectangle> rectangles;
+    };
+
+    struct Polygon {
+	Target target;
+	std::vector<XPoint> points;
+    };
+
+    struct Text {
+	Drawable drawable;
+	XftFont *font;
+	unsigned long pixel;
+
+	bool operator < (const Text& t) const
+	{
+	    if (drawable != t.drawable)
+		return drawable < t.drawable;
+	    if (font != t.font)
+		return font < t.font;
+	    return pixel < t.pixel;
+	}
+    };
+
+    std::vector<Fill> fills;				   // In order
+    std::map<Target, std::vector<XSegment> > segments;
+    std::map<Target, std::vector<XArc> > arcs;
+    std::vector<Polygon> polygons;			   // In order
+    std::map<Text, std::vector<XftGlyphSpec> > texts;
+    bool empty;			// True if nothing was collected
+
+    static DrawBatch *current;
+
+    void _flush();
+
+    // Cached text resources
+    XftDraw *xft_draw(Drawable drawable);
+    const XftColor& xft_color(unsigned long pixel);
+
+    DrawBatch(const DrawBatch&);
+    DrawBatch& operator = (const DrawBatch&);
+
+public:
+    // Collect requests for DISPLAY while this object exists
+    DrawBatch(Display *display);
+    ~DrawBatch();
+
+    // Draw line from (X1, Y1) to (X2, Y2)
+    static void line(Widget w, GC gc, int x1, int y1, int x2, int y2);
+
+    // Fill rectangle
+    static void fillRectangle(Widget w, GC gc, int x, int y,
+			      unsigned int width, unsigned int height);
+
+    // Draw arc (see XDrawArc())
+    static void arc(Widget w, GC gc, int x, int y,
+		    unsigned int width, unsigned int height,
+		    int angle1, int angle2);
+
+    // Fill convex polygon with the N POINTS
+    static void fillPolygon(Widget w, GC gc, const XPoint *points, int n);
+
+    // Draw UTF-8 text S in the foreground color of GC; (X, Y) is the
+    // base line origin.
+    static void text(Widget w, GC gc, XftFont *font, int x, int y,
+		     const string& s);
+
+    // Draw all requests collected so far
+    static void flush();
+
+    // Call before freeing D, if text may have been drawn into it
+    static void forget(Drawable d);
+};
+
+#endif // _DDD_DrawBatch_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -0,0 +1,91 @@
+// $Id$
+// Redirecting box drawing
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+// 
+// This file is part of DDD.
+// 
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+// 
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+// 
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page, 
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+
+#ifndef _DDD_DrawTarget_h
+#define _DDD_DrawTarget_h
+
+#include <X11/Xlib.h>
+#include <X11/Intrinsic.h>
+
+#include "BoxPoint.h"
+
+// Boxes and graphs draw into the window of the widget passed to
+// their draw() functions.  A DrawTarget temporarily redirects all
+// drawing for a widget into some other drawable (typically an
+// off-screen pixmap of the same depth as the window).
+//
+// Drawing is relative to ORIGIN: the point ORIGIN of the widget
+// becomes (0, 0) in the drawable.
+
+class DrawTarget {
+    Widget widget;		// Widget being redirected
+    Drawable drawable;		// Where to draw instead
+    BoxPoint _origin;		// Widget point drawn at (0, 0)
+
+    DrawTarget *saved;		// Enclosing redirection
+
+    static DrawTarget *current;
+
+    DrawTarget(const DrawTarget&);
+    DrawTarget& operator = (const DrawTarget&);
+
+public:
+    // Redirect drawing for W into D while this object exists
+    DrawTarget(Widget w, Drawable d, const BoxPoint& origin = BoxPoint(0, 0)):
+	widget(w), drawable(d), _origin(origin), saved(current)
+    {
+	current = this;
+    }
+
+    ~DrawTarget()
+    {
+	current = saved;
+    }
+
+    // Where drawing for W goes
+    static Drawable of(Widget w)
+    {
+	for (const DrawTarget *t = current; t != 0; t = t->saved)
+	    if (t->widget == w)
+		return t->drawable;
+
+	return XtWindow(w);
+    }
+
+    // Widget point drawn at (0, 0) of the drawable for W
+    static BoxPoint origin(Widget w)
+    {
+	for (const DrawTarget *t = current; t != 0; t = t->saved)
+	    if (t->widget == w)
+		return t->_origin;
+
+	return BoxPoint(0, 0);
+    }
+};
+
+#endif // _DDD_DrawTarget_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -69,6 +69,10 @@ public:
     static bool matchesAll;          // Flag: match all?
 
     bool isDummyBox() const { return true; }
+
+    // Dummies match anything; never share them
+    unsigned int hash() const           { return 0; }
+    bool identical(const Box& b) const  { return this == &b; }
 };
 
 #endif
@@ -33,6 +33,10 @@
 #include <X11/Xft/Xft.h>
 #include <X11/Xlib.h>
 #include <map>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "base/strclass.h"
 #include "base/TypeInfo.h"
@@ -40,6 +44,33 @@
 
 typedef XftFont BoxFont;
 
+// Text widths for a single font.  Widths of ASCII strings are summed
+// up from a table of character advances; other strings are measured
+// as a whole and kept in a small LRU cache.
+class FontMetrics {
+private:
+    Display* m_display;
+    BoxFont* m_font;
+
+    int m_advance[128];                 // -1 if not known yet
+
+    typedef std::list<std::pair<std::string, int> > LRUList;
+    LRUList m_lru;                      // most recently used first
+    std::unordered_map<std::string, LRUList::iterator> m_cached;
+
+    int advance(unsigned char c);
+    int measure(const char* s, int length);
+
+public:
+    // Number of non-ASCII strings to cache
+    static const unsigned int max_cached = 1024;
+
+    FontMetrics(Display* display, BoxFont* font);
+
+    // Width of the UTF-8 string S
+    int width(const char* s, int length);
+};
+
 class FontTable {
 public:
     DECLARE_TYPE_INFO
@@ -47,6 +78,7 @@ public:
 private:
     Display* m_display;
     std::map<string, BoxFont*> table;  // todo: switch to std::unordered_map
+    std::unordered_map<BoxFont*, FontMetrics*> metrics;
 
     FontTable(const FontTable&);
     FontTable& operator=(const FontTable&);
@@ -56,6 +88,8 @@ public:
 
     ~FontTable()
     {
+        for (auto& kv : metrics)
+            delete kv.second;
         for (auto& kv : table)
             if (kv.second)
                 XftFontClose(m_display, kv.second);
@@ -63,6 +97,12 @@ public:
 
     BoxFont* operator[](const string& name);
 
+    // Width of S when drawn in FONT
+    int width(BoxFont* font, const string& s);
+
+    // Names of all fonts looked up so far
+    void names(std::vector<string>& names) const;
+
     Display* getDisplay() { return m_display; }
 };
 
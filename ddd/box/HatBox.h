@@ -80,7 +80,41 @@ public:
 	theextend() = _box->extend();
 	return this; 
     }
-    void newFont(const string& font) { _box->newFont(font); resize(); }
+    void newFont(const string& font)
+    {
+	unintern();
+
+	// Don't change the font of boxes used elsewhere
+	if (_box->isShared())
+	{
+	    Box *copy = _box->dup();
+	    _box->unlink();
+	    _box = copy;
+	}
+
+	_box->newFont(font);
+	resize();
+    }
+
+    // Only share small boxes: those whose child is shared, too
+    Box *intern()
+    {
+	if (!_box->isInterned())
+	    return this;
+	return Box::intern();
+    }
+
+    // Structural hashing
+    unsigned int hash() const
+    {
+	unsigned int h = Box::hash();
+	return h == 0 ? 0 : hashmix(h, _box->hash());
+    }
+    bool identical(const Box& b) const
+    {
+	return Box::identical(b) &&
+	    _box->identical(*(((const HatBox *)&b)->_box)); // dirty trick
+    }
 
     void countMatchBoxes(int instances[]) const
     {
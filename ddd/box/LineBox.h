@@ -71,6 +71,17 @@ public:
     {}
     
     BoxCoordinate linethickness() const { return _linethickness; }
+
+    // Structural hashing
+    unsigned int hash() const
+    {
+	return hashmix(PrimitiveBox::hash(), _linethickness);
+    }
+    bool identical(const Box& b) const
+    {
+	return PrimitiveBox::identical(b) &&
+	    _linethickness == ((const LineBox *)&b)->_linethickness;  // dirty trick
+    }
 };
 
 
@@ -65,6 +65,9 @@ public:
 
     // Resources
     const BoxRegion& __region() const { return _region; }
+
+    // Move region of last draw (when the drawing is moved)
+    void __move(const BoxPoint& offset) const { _region.origin() += offset; }
 };
 
 #endif // _DDD_MarkBox_h
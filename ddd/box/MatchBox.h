@@ -74,6 +74,9 @@ public:
 
     Box *dup() const { return new MatchBox(*this); }
 
+    // Associated data
+    int data() const { return _data; }
+
     static MatchBoxFunc matchCallback;  // Match callback
 
     // Count match boxes
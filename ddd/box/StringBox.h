@@ -30,6 +30,7 @@
 #define _DDD_StringBox_h
 
 #include "base/strclass.h"
+#include "base/hash.h"
 #include "Box.h"
 #include "PrimitiveB.h"
 #include "FontTable.h"
@@ -112,6 +113,20 @@ public:
     Box *resize();
 
     bool isStringBox() const { return true; }
+
+    // Structural hashing
+    unsigned int hash() const
+    {
+	unsigned int h = hashmix(PrimitiveBox::hash(), hashpjw(m_string.chars()));
+	return hashmix(h, hashpjw(m_fontname.chars()));
+    }
+    bool identical(const Box& b) const
+    {
+	return PrimitiveBox::identical(b) &&
+	    m_string == ((const StringBox *)&b)->m_string &&  // dirty trick
+	    m_fontname == ((const StringBox *)&b)->m_fontname &&
+	    m_font == ((const StringBox *)&b)->m_font;
+    }
 };
 
 #endif
@@ -95,6 +95,10 @@ public:
     bool __selected() const  { return (*(datalink->selected))(_data); }
     string __name() const       { return (*(datalink->name))(_data); }
     string __info() const       { return (*(datalink->info))(_data); }
+
+    // Tagged boxes are never shared
+    unsigned int hash() const           { return 0; }
+    bool identical(const Box& b) const  { return this == &b; }
 };
 
 #endif
@@ -0,0 +1,77 @@
+// $Id$
+// SVG output primitives
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_printSVG_h
+#define _DDD_printSVG_h
+
+// Elements written when printing boxes as SVG.  Coordinates are in
+// pixels; the origin is upper left, as on the screen.  Elements are
+// drawn in `currentColor', such that svgBeginColor() and svgEndColor()
+// can change the color of everything in between.
+
+#include <iostream>
+
+#include "base/strclass.h"
+#include "BoxPoint.h"
+#include "BoxSize.h"
+#include "BoxC.h"
+
+// Quote S for use in XML text and attributes
+extern string svgcook(const string& s);
+
+// Line from P1 to P2
+extern void svgLine(std::ostream& os, const BoxPoint& p1, const BoxPoint& p2,
+		    BoxCoordinate width = 1);
+
+// Filled rectangle; if FILL is given, use it instead of current color
+extern void svgRect(std::ostream& os, const BoxPoint& origin, 
+		    const BoxSize& space, const char *fill = 0);
+
+// Arc within the ellipse bounded by ORIGIN and SPACE, starting at
+// START degrees, extending LENGTH degrees (counter-clockwise, as in
+// XDrawArc())
+extern void svgArc(std::ostream& os, const BoxPoint& origin, 
+		   const BoxSize& space, int start, int length,
+		   BoxCoordinate width = 1);
+
+// Arrow head at POS.  ALPHA is the direction of the line (in radians,
+// pointing away from POS), ANGLE and LENGTH the arrow shape.
+extern void svgArrowHead(std::ostream& os, const BoxPoint& pos, double alpha,
+			 unsigned angle, unsigned length);
+
+// Text S in the rectangle given by ORIGIN and SIZE; the base line is
+// at ASCENT below ORIGIN.
+extern void svgText(std::ostream& os, const BoxPoint& origin, 
+		    const BoxSize& size, BoxCoordinate ascent,
+		    const string& s);
+
+// Group drawn in another color
+extern void svgBeginColor(std::ostream& os, unsigned short red,
+			  unsigned short green, unsigned short blue);
+extern void svgEndColor(std::ostream& os);
+
+#endif // _DDD_printSVG_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
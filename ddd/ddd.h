@@ -51,6 +51,12 @@ extern void gdb_out(const string& text);
 // Output TEXT in GDB window (unconditionally)
 extern void _gdb_out(const string& text);
 
+// Show GDB output held back so far
+extern void flush_gdb_out();
+
+// Return statistics on GDB output
+extern string gdb_out_statistics();
+
 // Update option menus
 extern void update_options();
 
@@ -75,6 +81,9 @@ extern XmTextPosition promptPosition;
 // Last message position
 extern XmTextPosition messagePosition;
 
+// Number of lines in the debugger console
+extern int console_lines;
+
 // True if output is running
 extern bool private_gdb_output;
 
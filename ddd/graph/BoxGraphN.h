@@ -32,6 +32,8 @@
 #include "box/Box.h"
 #include "box/MarkBox.h"
 
+#include <list>
+
 class BoxGraphNode: public RegionGraphNode {
 public:
     DECLARE_TYPE_INFO
@@ -39,9 +41,33 @@ public:
 private:
     Box *_box;		 // the box
     MarkBox *_highlight; // box to be highlighted when selected
+    mutable Box *_title; // title drawn when zoomed out (0: not built yet)
+
+    // Cached rendering of the box, in a pixmap of the node's size
+    mutable Display *_display;	   // Display of pixmap
+    mutable Pixmap _pixmap;	   // Rendered box (None if not cached)
+    mutable BoxSize _pixmapSize;   // Size of pixmap
+    mutable BoxPoint _pixmapOrigin; // Node origin when rendered
+    mutable bool _pixmapSelected;  // Selection state when rendered
+    mutable GC _pixmapGC;	   // Node GC when rendered
+    mutable bool _pixmapColor;	   // Color state when rendered
+    mutable std::list<const BoxGraphNode *>::iterator _lruPos;
+				   // Position in list of cached nodes
 
     BoxGraphNode& operator = (const BoxGraphNode&);
 
+    // Draw box into W
+    void drawBox(Widget w, const GraphGC& gc) const;
+
+    // Draw outline and title only (for low zoom levels)
+    void drawOutline(Widget w, const GraphGC& gc) const;
+
+    // Title drawn by drawOutline()
+    Box *title() const;
+
+    // True iff pixmap matches current state
+    bool pixmapValid(const GraphGC& gc) const;
+
 protected:
     // Draw
     virtual void forceDraw(Widget w, 
@@ -60,13 +86,21 @@ public:
 		 MarkBox *h = 0)
 	: RegionGraphNode(initialPos, b->size()),
 	  _box(b->link()),
-	  _highlight(h)
+	  _highlight(h),
+	  _title(0),
+	  _display(0), _pixmap(None), _pixmapSize(), _pixmapOrigin(),
+	  _pixmapSelected(false), _pixmapGC(0), _pixmapColor(false),
+	  _lruPos()
     {}
 
     BoxGraphNode()
 	: RegionGraphNode(),
 	  _box(0),
-	  _highlight(0)
+	  _highlight(0),
+	  _title(0),
+	  _display(0), _pixmap(None), _pixmapSize(), _pixmapOrigin(),
+	  _pixmapSelected(false), _pixmapGC(0), _pixmapColor(false),
+	  _lruPos()
     {}
 
     GraphNode *dup() const
@@ -77,8 +111,11 @@ public:
     // Destructor
     virtual ~BoxGraphNode()
     {
+	invalidate();
 	if (_box)
 	    _box->unlink();
+	if (_title)
+	    _title->unlink();
     }
 
     // Attributes
@@ -99,12 +136,18 @@ public:
     // The highlight box must be a child of the displayed box.
     void setHighlight(MarkBox *b = 0)
     {
+	if (b != _highlight)
+	    invalidate();
 	_highlight = b;
     }
 
     // Set the box.
     void setBox(Box *b);
 
+    // Discard cached rendering
+    void invalidate();
+    virtual void releaseDrawCache() const;
+
     // Print
     virtual void _print(std::ostream& os, const GraphGC& gc) const;
 };
@@ -35,6 +35,10 @@
 #include "box/Box.h"
 #include "base/TypeInfo.h"
 
+#include <vector>
+
+class GraphGrid;
+
 class Graph {
 public:
     DECLARE_TYPE_INFO
@@ -43,8 +47,21 @@ private:
     GraphNode *_firstNode;	// circular list (0 if empty)
     GraphEdge *_firstEdge;	// circular list (0 if empty)
 
+    long _minOrder;		// drawing order of first node
+    long _maxOrder;		// drawing order of last node
+    long _minEdgeOrder;		// drawing order of first edge
+    long _maxEdgeOrder;		// drawing order of last edge
+
+    mutable GraphGrid *_grid;	// spatial index (0 if not built yet)
+
     Graph& operator = (const Graph&);
 
+    // True iff N1 is drawn before N2
+    static bool drawn_before(GraphNode *n1, GraphNode *n2);
+
+    // True iff E1 is drawn before E2
+    static bool edge_drawn_before(GraphEdge *e1, GraphEdge *e2);
+
     void begin_color(std::ostream& os, const PrintGC& gc,
 		     unsigned short red,
 		     unsigned short green,
@@ -72,7 +89,8 @@ protected:
 public:
     // Constructors
     Graph():
-	_firstNode(0), _firstEdge(0)
+	_firstNode(0), _firstEdge(0), _minOrder(0), _maxOrder(0),
+	_minEdgeOrder(0), _maxEdgeOrder(0), _grid(0)
     {}
 
     // Destructor
@@ -168,6 +186,23 @@ public:
     void makeEdgeFirst(GraphEdge *edge);
     void makeEdgeLast(GraphEdge *edge);
 
+    // Spatial queries.  These use a spatial index and thus only
+    // look at nodes and edges near the given point or region.
+
+    // Topmost visible node whose sensitive region contains P (0 if none)
+    GraphNode *nodeAt(const BoxPoint& p, const GraphGC& gc) const;
+
+    // Visible nodes whose region meets R, in drawing order
+    void nodesIn(const BoxRegion& r, const GraphGC& gc,
+		 std::vector<GraphNode *>& nodes) const;
+
+    // Visible edges that may be drawn in R, in drawing order
+    void edgesIn(const BoxRegion& r, const GraphGC& gc,
+		 std::vector<GraphEdge *>& edges) const;
+
+    // Notify the graph that NODE has changed its position or size
+    void nodeChanged(GraphNode *node);
+
     // Drawing
     void draw(Widget w, const BoxRegion& exposed, const GraphGC& gc) const;
     void draw(Widget w, const BoxRegion& exposed) const
@@ -181,6 +216,7 @@ public:
 
     // Printing
     void _print(std::ostream& os, const GraphGC& gc) const;
+    int printItems(const GraphGC& gc) const;
     void _printHeader(std::ostream& os, const GraphGC& gc) const
     {
 	Box::_printHeader(os, region(gc, gc.printSelectedNodesOnly), 
@@ -64,6 +64,7 @@ private:
     GraphEdge *next;		// For collectors
     GraphEdge *prev;
     Graph *graph;
+    long order;			// Position in drawing order
 
     GraphEdge& operator = (const GraphEdge&);
 
@@ -91,7 +92,8 @@ protected:
         _prevTo(0),
         next(0),
         prev(0),
-	graph(0)
+	graph(0),
+	order(0)
     {}
 
 public:
@@ -102,7 +104,7 @@ public:
         _hidden(false),
         _nextFrom(0), _nextTo(0),
         _prevFrom(0), _prevTo(0),
-        next(0), prev(0), graph(0)
+        next(0), prev(0), graph(0), order(0)
     {}
 
     // Destructor
@@ -112,6 +112,7 @@ typedef struct _GraphEditPart {
     Dimension arrowAngle;	// Arrow angle (in degrees)
     Dimension arrowLength;	// Arrow length (in pixels)
     Dimension selfEdgeDiameter; // Diameter of edge pointing at self
+    Dimension detailThreshold;	// Min zoom for node details (in percent)
 
     // Requested sizes; for panner and scrollbar creation only
     Dimension requestedWidth;	// Requested width (in pixels)
@@ -193,6 +194,10 @@ typedef struct _GraphEditPartPrivate {
 
     Pixmap gridPixmap;		// Grid pixmap
 
+    Pixmap redrawPixmap;	// Off-screen buffer for redrawing
+    unsigned int redrawWidth;	// Its width
+    unsigned int redrawHeight;	// Its height
+
     Boolean sizeChanged;	// Flag: size changed in SetValues
     Boolean redisplayEnabled;	// Flag: redisplay is enabled
 
@@ -69,6 +69,7 @@ class GraphGC {
     bool           drawArrowHeads;   // Flag: draw arrow heads?
     bool           drawHints;        // Flag: draw hints?
     bool	   drawAnnotations;  // Flag: draw annotations?
+    bool           drawDetails;      // Flag: draw node contents, arrows...?
     BoxCoordinate  hintSize;         // Hint size (in pixels)
     unsigned       arrowAngle;       // Arrow angle (in degrees)
     unsigned       arrowLength;      // Arrow length (in pixels)
@@ -80,6 +81,8 @@ class GraphGC {
     // Printing stuff
     PrintGC     *printGC;               // Graphics context for printing
     bool        printSelectedNodesOnly; // Flag: print selected nodes only?
+    bool        (*printProgress)(int);  // Called with the number of items
+					// left to print; true means abort
 
     unsigned short edge_red;	        // Colors to use for edges [0..65535]
     unsigned short edge_green;
@@ -104,6 +107,7 @@ class GraphGC {
         drawArrowHeads(true),
         drawHints(false),
         drawAnnotations(true),
+        drawDetails(true),
         hintSize(8),
         arrowAngle(30),
         arrowLength(10),
@@ -112,6 +116,7 @@ class GraphGC {
 	selfEdgeDirection(Counterclockwise),
 	printGC(&defaultPrintGC),
 	printSelectedNodesOnly(false),
+	printProgress(0),
 	edge_red(0),
 	edge_green(0),
 	edge_blue(0),
@@ -133,6 +138,7 @@ class GraphGC {
         drawArrowHeads(g.drawArrowHeads),
         drawHints(g.drawHints),
         drawAnnotations(g.drawAnnotations),
+        drawDetails(g.drawDetails),
         hintSize(g.hintSize),
         arrowAngle(g.arrowAngle),
         arrowLength(g.arrowLength),
@@ -141,6 +147,7 @@ class GraphGC {
 	selfEdgeDirection(g.selfEdgeDirection),
 	printGC(g.printGC),
 	printSelectedNodesOnly(g.printSelectedNodesOnly),
+	printProgress(g.printProgress),
 	edge_red(g.edge_red),
 	edge_green(g.edge_green),
 	edge_blue(g.edge_blue),
@@ -165,6 +172,7 @@ class GraphGC {
 	    drawArrowHeads         = g.drawArrowHeads;
 	    drawHints              = g.drawHints;
 	    drawAnnotations        = g.drawAnnotations;
+	    drawDetails            = g.drawDetails;
 	    hintSize               = g.hintSize;
 	    arrowAngle             = g.arrowAngle;
 	    arrowLength            = g.arrowLength;
@@ -173,6 +181,7 @@ class GraphGC {
 	    selfEdgeDirection      = g.selfEdgeDirection;
 	    printGC                = g.printGC;
 	    printSelectedNodesOnly = g.printSelectedNodesOnly;
+	    printProgress          = g.printProgress;
 	    edge_red               = g.edge_red;
 	    edge_green             = g.edge_green;
 	    edge_blue              = g.edge_blue;
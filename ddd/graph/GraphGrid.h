@@ -0,0 +1,148 @@
+// $Id$ -*- C++ -*-
+// Spatial index on graph nodes and edges
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_GraphGrid_h
+#define _DDD_GraphGrid_h
+
+// A GraphGrid is a uniform grid over the regions of the nodes and
+// edges of a graph.  It answers `which nodes and edges are near this
+// point or region' by looking at nearby cells only.
+//
+// The grid is maintained lazily: the graph reports added, removed
+// and changed nodes and edges; these are re-entered into the grid
+// upon the next query.  Regions depend on the GraphGC; if a query
+// uses a GraphGC with different geometry settings, the grid is
+// rebuilt from scratch.
+
+#include "box/BoxRegion.h"
+#include "GraphGC.h"
+
+#include <vector>
+#include <unordered_map>
+
+class Graph;
+class GraphNode;
+class GraphEdge;
+
+class GraphGrid {
+public:
+    // Width and height of a grid cell (in pixels)
+    static const BoxCoordinate cellSize = 128;
+
+    // Edges covering more cells than this are not entered into cells
+    static const int maxEdgeCells = 64;
+
+private:
+    typedef unsigned long long Key;
+
+    // Cells occupied by some object, and whether it must be re-entered
+    struct Entry {
+	int x0, y0, x1, y1;	// Cell range (inclusive), if indexed
+	bool indexed;		// Flag: entered into cells?
+	bool large;		// Flag: on the list of large edges instead?
+	bool dirty;		// Flag: on the pending list?
+
+	Entry():
+	    x0(0), y0(0), x1(-1), y1(-1), indexed(false), large(false),
+	    dirty(false)
+	{}
+    };
+
+    struct Cell {
+	std::vector<GraphNode *> nodes;
+	std::vector<GraphEdge *> edges;
+    };
+
+    const Graph *graph;		// The graph indexed
+
+    std::unordered_map<Key, Cell> cells;
+    std::unordered_map<GraphNode *, Entry> node_entries;
+    std::unordered_map<GraphEdge *, Entry> edge_entries;
+
+    // Edges covering more than maxEdgeCells cells (say, long diagonal
+    // ones).  These are checked one by one upon each query.
+    std::vector<GraphEdge *> large_edges;
+
+    std::vector<GraphNode *> pending_nodes;
+    std::vector<GraphEdge *> pending_edges;
+
+    bool valid;			// Flag: grid matches graph?
+    GraphGC gc;			// GC used for computing regions
+
+    // Cell key: Y in the upper, X in the lower 32 bits
+    static Key key(int x, int y)
+    {
+	return (Key((unsigned int)y) << 32) | Key((unsigned int)x);
+    }
+    static int cell(BoxCoordinate c)
+    {
+	return c >= 0 ? c / cellSize : -((-c - 1) / cellSize) - 1;
+    }
+    static void cells_of(const BoxRegion& r, int& x0, int& y0,
+			 int& x1, int& y1);
+
+    bool same_geometry(const GraphGC& gc) const;
+    BoxRegion node_region(GraphNode *node) const;
+    BoxRegion edge_region(GraphEdge *edge) const;
+
+    void enter(GraphNode *node, Entry& entry);
+    void enter(GraphEdge *edge, Entry& entry);
+    void leave(GraphNode *node, Entry& entry);
+    void leave(GraphEdge *edge, Entry& entry);
+
+    void rebuild();
+    void update(const GraphGC& gc);
+
+    GraphGrid(const GraphGrid&);
+    GraphGrid& operator = (const GraphGrid&);
+
+public:
+    // Constructor
+    GraphGrid(const Graph *g):
+	graph(g), cells(), node_entries(), edge_entries(), large_edges(),
+	pending_nodes(), pending_edges(), valid(false), gc()
+    {}
+
+    // Notifications
+    void nodeAdded(GraphNode *node);
+    void nodeRemoved(GraphNode *node);
+    void nodeChanged(GraphNode *node);
+    void edgeAdded(GraphEdge *edge);
+    void edgeRemoved(GraphEdge *edge);
+    void invalidate() { valid = false; }
+
+    // Queries.  Hidden nodes and edges are included; the caller
+    // filters them.  Results are unordered and free of duplicates.
+    void nodesAt(const BoxPoint& p, const GraphGC& gc,
+		 std::vector<GraphNode *>& nodes);
+    void nodesIn(const BoxRegion& r, const GraphGC& gc,
+		 std::vector<GraphNode *>& nodes);
+    void edgesIn(const BoxRegion& r, const GraphGC& gc,
+		 std::vector<GraphEdge *>& edges);
+};
+
+#endif // _DDD_GraphGrid_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
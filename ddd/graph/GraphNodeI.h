@@ -57,10 +57,14 @@ private:
     GraphNode *next;		// For collectors
     GraphNode *prev;		// For collectors
     Graph *graph;		// For collectors
+    long order;			// Position in drawing order
 
     GraphNode& operator = (const GraphNode&);
 
 protected:
+    // Tell graph that position or size has changed
+    void geometryChanged();
+
     // Copy Constructor
     GraphNode(const GraphNode& node):
 	_id(),
@@ -72,6 +76,7 @@ protected:
 	next(0),
 	prev(0),
 	graph(0),
+	order(0),
 	count(0)
     {}
 
@@ -81,7 +86,8 @@ public:
     // Constructor
     GraphNode():
 	_id(), _selected(false), _hidden(false), _redraw(false),
-	_firstFrom(0), _firstTo(0), next(0), prev(0), graph(0), count(0)
+	_firstFrom(0), _firstTo(0), next(0), prev(0), graph(0), order(0),
+	count(0)
     {}
 
     // Destructor
@@ -149,6 +155,12 @@ public:
 	// Default: do nothing
     }
 
+    // Release resources kept for drawing (e.g. when not shown)
+    virtual void releaseDrawCache() const
+    {
+	// Default: do nothing
+    }
+
     // Custom drawing functions
     void draw(Widget w, const BoxRegion& exposed) const
     {
@@ -65,6 +65,16 @@ void setLabelList (Widget  selectionList,
 		   bool    highlight_title,
 		   bool    notify);
 
+// Like setLabelList(), but only replace the items and selection
+// states that differ.  SHOWN holds the labels of the last call; pass
+// the same vector each time.  Callbacks are not invoked.
+void changeLabelList (Widget  selectionList,
+		      const string  label_list[],
+		      const bool selected[],
+		      int     list_length,
+		      bool    highlight_title,
+		      std::vector<string>& shown);
+
 // Replace all elements in SELECTIONLIST with the corresponding
 // entries in LABEL_LIST (i.e. with the same leading number).
 void updateLabelList (Widget  selectionList,
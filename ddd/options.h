@@ -67,6 +67,7 @@ void check_options_file();
 // Lots and lots of callbacks
 extern void sourceToggleFindWordsOnlyCB     (Widget, XtPointer, XtPointer);
 extern void sourceToggleFindCaseSensitiveCB (Widget, XtPointer, XtPointer);
+extern void sourceToggleFindRegexpCB        (Widget, XtPointer, XtPointer);
 extern void sourceToggleCacheSourceFilesCB  (Widget, XtPointer, XtPointer);
 extern void sourceToggleCacheMachineCodeCB  (Widget, XtPointer, XtPointer);
 extern void sourceSetIntRegistersCB         (Widget, XtPointer, XtPointer);
@@ -105,6 +106,9 @@ extern void dddToggleValueDocsCB            (Widget, XtPointer, XtPointer);
 
 extern void dddSetCrashCB                   (Widget, XtPointer, XtPointer);
 extern void dddClearMaintenanceCB           (Widget, XtPointer, XtPointer);
+extern void dddToggleProfileVSLCB           (Widget, XtPointer, XtPointer);
+extern void dddWriteVSLProfileCB            (Widget, XtPointer, XtPointer);
+extern void dddConsoleStatisticsCB          (Widget, XtPointer, XtPointer);
 
 extern void dddSetGlobalTabCompletionCB     (Widget, XtPointer, XtPointer);
 extern void dddSetSeparateWindowsCB         (Widget, XtPointer, XtPointer);
@@ -47,6 +47,7 @@ public:
     DECLARE_TYPE_INFO
 
     friend class DefCallNode;
+    friend class VSLImage;		// Saves _index
 
 private:
     int _index;
@@ -45,6 +45,8 @@ class CallNode: public VSLNode {
 public:
     DECLARE_TYPE_INFO
 
+    friend class VSLCode;		// Calls call()
+
 protected:
     VSLNode *_arg;
 
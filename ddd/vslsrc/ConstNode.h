@@ -42,6 +42,7 @@
 class ConstNode: public VSLNode {
 public:
     DECLARE_TYPE_INFO
+    friend class VSLImage;		// Saves _box
 
 private:
     Box *_box;
@@ -45,6 +45,7 @@
 class DefCallNode: public CallNode {
 public:
     DECLARE_TYPE_INFO
+    friend class VSLImage;		// Saves and restores _def
 
 private:
     VSLDef *_def;           // points to definition if unambiguous, else 0
@@ -52,6 +52,8 @@ class LetNode: public CallNode {
 public:
     DECLARE_TYPE_INFO
 
+    friend class VSLCode;		// Calls arglist()
+
 private:
     VSLNode *_node_pattern;	// Pattern
     mutable Box *_box_pattern;		// Compiled pattern
@@ -38,6 +38,20 @@ private:
     unsigned _optimizeMode;
     std::vector<string> _theme_list;
 
+    // Images (see VSLImage.h)
+    string _image_dir;		// Where images are kept ("" if none)
+    string _source_name;	// Library file, if read from file
+    string _source_text;	// Library text, if read from stream
+
+    VSLLib *original_lib();
+    void build();
+
+    string image_key(const std::vector<string>& themes) const;
+    string image_file(const string& key) const;
+    bool load_image(const std::vector<string>& themes);
+    void save_image(const std::vector<string>& themes) const;
+    void prune_images() const;
+
     // Assignment
     ThemedVSLLib& operator=(const ThemedVSLLib&);
 
@@ -50,6 +64,14 @@ public:
     ThemedVSLLib(const string& lib_name, unsigned optimizeMode = stdOpt);
     ThemedVSLLib(std::istream& s, unsigned optimizeMode = stdOpt);
 
+    // Build, using precompiled images in IMAGE_DIR.  Images are
+    // created as needed, for the library as well as for each theme
+    // list set.
+    ThemedVSLLib(const string& lib_name, unsigned optimizeMode,
+		 const string& image_dir);
+    ThemedVSLLib(std::istream& s, unsigned optimizeMode,
+		 const string& image_dir);
+
     // Optimize
     virtual void optimize(unsigned mode = stdOpt);
 
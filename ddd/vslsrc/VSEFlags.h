@@ -94,6 +94,8 @@ public:
 
     static unsigned optimize_mode();
     static bool incremental_eval;
+    static bool bytecode_eval;
+    static bool memoize_eval;
     static bool optimize_globals;
 
     // modes
@@ -107,6 +109,7 @@ public:
     static bool show_eval_time;
     static bool show_optimizing_time;
     static bool show_display_time;
+    static bool profile_eval;
 
     // eval options
     static bool suppress_eval;
@@ -0,0 +1,103 @@
+// $Id$
+// VSL bytecode
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_VSLCode_h
+#define _DDD_VSLCode_h
+
+// A VSLCode is the body of a VSL definition, compiled into a flat
+// sequence of instructions for a small stack machine.  Running the
+// code has the same effect as evaluating the expression tree: the
+// same boxes are built, the same functions are called and the same
+// errors are reported.  Tree walking, virtual _eval() calls and
+// argument list lookups are replaced by a single dispatch loop.
+//
+// The code refers to the nodes of the expression it was compiled
+// from; hence, it must be discarded whenever the expression changes.
+
+#include <vector>
+
+#include "base/TypeInfo.h"
+
+class Box;
+class ListBox;
+class VSLNode;
+
+class VSLCode {
+public:
+    DECLARE_TYPE_INFO
+
+private:
+    enum Opcode {
+	PushConst,		// Push constant A
+	PushArg,		// Push argument A (node B if missing)
+	Cons,			// Replace HEAD, TAIL by [HEAD|TAIL]
+	Call,			// Replace ARG by result of call node A
+	Test,			// Pop flag; if false, goto A; if invalid, B
+	Let,			// Bind pattern of let node A; if failed, goto B
+	Unlet,			// Unbind innermost let
+	Jump,			// Goto A
+	JumpIfNull,		// If top of stack is 0, goto A
+	Eval			// Push value of node A (tree evaluation)
+    };
+
+    struct Instr {
+	Opcode op;
+	int a;
+	int b;
+
+	Instr(Opcode o, int x, int y):
+	    op(o), a(x), b(y)
+	{}
+    };
+
+    std::vector<Instr> code;		// Instructions
+    std::vector<const Box *> consts;	// Constant pool
+    std::vector<const VSLNode *> nodes;	// Nodes referenced by code
+
+    int emit(Opcode op, int a = 0, int b = 0);
+    int here() const { return int(code.size()); }
+    int node(const VSLNode *n);
+    void compile(const VSLNode *expr);
+
+    VSLCode(const VSLCode&);
+    VSLCode& operator = (const VSLCode&);
+
+public:
+    // Constructor: compile EXPR
+    VSLCode(const VSLNode *expr);
+
+    // Destructor
+    ~VSLCode();
+
+    // Evaluate with arguments ARGLIST
+    const Box *run(ListBox *arglist) const;
+
+    // Number of instructions
+    int size() const { return int(code.size()); }
+};
+
+#endif // _DDD_VSLCode_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -39,6 +39,7 @@
 
 class Box;
 class VSLDefList;
+class VSLCode;
 
 class VSLDef {
 public:
@@ -63,6 +64,16 @@ private:
 
     mutable bool being_compiled;	// Protect against recursive compilePattern()
 
+    VSLCode *_code;		// Compiled expr (or 0)
+
+    // Profile (if VSEFlags::profile_eval is set)
+    mutable unsigned long _calls;	// Number of calls
+    mutable unsigned long _memo_hits;	// Calls served from memo
+    mutable double _self_time;		// Time spent in this def (s)
+    mutable double _total_time;		// Time spent including callees (s)
+    mutable unsigned long _boxes;	// Boxes created in this def
+    mutable int _active;		// Number of current activations
+
 public:
     VSLDefList *deflist;        // Parent
 
@@ -108,6 +119,17 @@ public:
     // Evaluate
     const Box *eval(Box *arg) const;
 
+    // Profile
+    unsigned long calls() const  { return _calls; }
+    unsigned long memo_hits() const { return _memo_hits; }
+    double self_time() const     { return _self_time; }
+    double total_time() const    { return _total_time; }
+    unsigned long boxes() const  { return _boxes; }
+    void reset_profile() const;
+
+    // Note a call served from memo (see VSLLib::eval())
+    void count_memo_hit() const { _memo_hits++; }
+
     // Backtrace (in error handling)
     static const VSLDef **backtrace;
     static const Box **backtrace_args;
@@ -123,6 +145,15 @@ public:
 	MUTABLE_THIS(VSLDef *)->_box_pattern = 0;
     }
 
+    // Compile expr into code
+    void compile();
+
+    // Destroy code; must be called whenever expr changes
+    void uncompile();
+
+    // Flag: do we have code?
+    bool compiled() const { return _code != 0; }
+
     // Resolve names
     int resolveNames();
 
@@ -0,0 +1,133 @@
+// $Id$
+// VSL library images
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_VSLImage_h
+#define _DDD_VSLImage_h
+
+// A VSL image is a binary file holding an optimized VSL library.
+// Loading an image takes a single read; parsing and optimizing are
+// skipped altogether.
+//
+// An image is tagged with a KEY describing how the library was built
+// (sources, themes, optimization mode).  It also records all files
+// read while parsing, along with their modification times, and the
+// metrics of all fonts used, since boxes computed while optimizing
+// depend on them.  An image is only loaded if its key matches and
+// none of these files and fonts has changed since.
+//
+// Not every library can be saved; if some node or box cannot be
+// represented in an image, saving fails and the library must be
+// parsed as usual.
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "base/strclass.h"
+#include "base/TypeInfo.h"
+
+class Box;
+class VSLLib;
+class VSLDef;
+class VSLNode;
+
+class VSLImage {
+public:
+    DECLARE_TYPE_INFO
+
+private:
+    enum NodeTag {
+	NodeNone, NodeConst, NodeList, NodeArg, NodeDummy, NodeName,
+	NodeBuiltinCall, NodeDefCall, NodeTest, NodeLet, NodeWhere
+    };
+
+    enum BoxTag {
+	BoxNone, BoxString, BoxTrue, BoxFalse, BoxNull, BoxSquare,
+	BoxSpace, BoxFill, BoxRule, BoxDiag, BoxRise, BoxFall,
+	BoxArc, BoxMatch, BoxDummy, BoxList, BoxHAlign, BoxVAlign,
+	BoxUAlign, BoxTAlign, BoxHFix, BoxVFix, BoxFontFix,
+	BoxForeground, BoxBackground
+    };
+
+    std::string out;		// Image being written
+    const char *in;		// Image being read
+    const char *in_end;		// End of image being read
+    bool ok;			// False if encoding or decoding failed
+    bool check_sizes;		// Flag: verify sizes of boxes read?
+    int depth;			// Nesting of nodes and boxes
+
+    VSLLib *lib;		// Library being read
+    std::vector<VSLDef *> defs;	// Definitions, in library order
+    std::map<const VSLDef *, int> def_index; // Inverse of DEFS
+
+    // Primitives
+    void put(const void *p, int n) { out.append((const char *)p, n); }
+    void put_int(int i)            { put(&i, sizeof(i)); }
+    void put_string(const string& s);
+
+    void get(void *p, int n);
+    int get_int();
+    string get_string();
+
+    // Nodes and boxes
+    void put_node(const VSLNode *node, bool in_pattern = false);
+    void put_box(const Box *box);
+    void _put_box(const Box *box);
+    VSLNode *get_node();
+    Box *get_box();
+
+    // Track nesting; return false if too deep
+    bool enter();
+    void leave() { depth--; }
+
+    // Whole library
+    void put_header(const VSLLib& lib, const string& key);
+    void put_fonts();
+    bool get_fonts();
+    void put_defs(const VSLLib& lib);
+    bool get_header(const string& key, string& lib_name,
+		    std::vector<string>& sources);
+    void get_defs();
+
+    VSLImage();
+    VSLImage(const std::string& image);
+
+    VSLImage(const VSLImage&);
+    VSLImage& operator = (const VSLImage&);
+
+public:
+    // Save LIB as image FILE, tagged with KEY.  Return true iff ok.
+    static bool save(const VSLLib& lib, const string& file,
+		     const string& key);
+
+    // Replace LIB by image FILE.  Return true iff ok.  If the image
+    // does not exist, is out of date, or is not tagged with KEY, LIB
+    // is left unchanged.
+    static bool load(VSLLib& lib, const string& file, const string& key);
+};
+
+#endif // _DDD_VSLImage_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -30,6 +30,8 @@
 #define _DDD_VSLLib_h
 
 #include <iostream>
+#include <unordered_map>
+#include <vector>
 #include "base/strclass.h"
 
 #include "VSEFlags.h"
@@ -59,11 +61,11 @@ public:
     {}
 
     VSLArg(const char *s)
-	:_box(new StringBox(s))
+	:_box((new StringBox(s))->intern())
     {}
     
     VSLArg(const string& s)
-	:_box(new StringBox(s))
+	:_box((new StringBox(s))->intern())
     {}
     
     VSLArg(int n)
@@ -164,6 +166,7 @@ int VSLLib_parse(void);
 class VSLLib {
     friend class VSLDefList;	    // VSLDefList::replace() needs this
     friend class DefCallNode;	    // DefCallNode::rebind() needs this
+    friend class VSLImage;	    // VSLImage::load() needs this
 
 public:
     DECLARE_TYPE_INFO
@@ -173,9 +176,27 @@ private:
     VSLDefList *defs[hashSize];     // hash table containing definitions
     VSLDef *_first;                 // linked list over definitions
     VSLDef *_last;                  // last def in list
+    std::vector<string> _sources;   // files read
 
     void initHash();
 
+    // Memoized eval() results, keyed by argument hash
+    struct Memo {
+	const VSLDefList *deflist;  // function called
+	Box *arg;                   // argument list
+	const Box *result;          // result
+    };
+    mutable std::unordered_multimap<unsigned int, Memo> memo;
+
+    const Box *recall(unsigned int hash, const VSLDefList *d,
+		      const Box *arg) const;
+    void remember(unsigned int hash, const VSLDefList *d,
+		  const Box *arg, const Box *result) const;
+    void forget() const;            // clear memo
+
+    static unsigned int eval_messages;  // #messages issued by eval_echo()
+    static unsigned int parse_messages; // #messages issued by parse_echo()
+
     // Optimizing and post-processing
     int bind();                     // bind internal functions to references
     int resolveNames();             // bind names to variables
@@ -187,6 +208,8 @@ private:
     int inlineFuncs();              // perform function inlining
     int countSelfReferences();      // count references internal to functions
     int cleanup();                  // remove unreferenced functions
+    int compile();                  // compile functions into code
+    int uncompile();                // destroy compiled code
 
     // Build function call with arglist as argument
     VSLNode *_call(const string& func_name, VSLNode *arglist);
@@ -268,6 +291,10 @@ public:
     virtual void update(std::istream& is);
     static int parse();
 
+    // Files read so far
+    const std::vector<string>& sources() const { return _sources; }
+    void add_source(const string& filename);
+
     // Optimize
     virtual void optimize(unsigned mode = stdOpt);
 
@@ -316,12 +343,19 @@ public:
     static void eval_error(const string& s, const VSLDef *def = 0);
     static void eval_warning(const string& s, const VSLDef *def = 0);
 
+    // Number of messages issued so far
+    static unsigned int messages() { return parse_messages + eval_messages; }
+
     // Debugging
     friend std::ostream& operator << (std::ostream& s, const VSLLib& lib);
     void dumpTree(std::ostream& s) const;
     VSLDef *lastdef()  { return _last; }
     VSLDef *firstdef() { return _first; }
 
+    // Profile (if VSEFlags::profile_eval is set)
+    void profile(std::ostream& s) const;
+    void reset_profile() const;
+
     // Background processing
     static void (*background)();
 
@@ -50,6 +50,7 @@ class VSLNode;
 class VSLNode {
 public:
     DECLARE_TYPE_INFO
+    friend class VSLImage;		// Saves and restores _base
 
 private:
     const char *_type;    // Type